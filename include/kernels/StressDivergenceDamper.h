@@ -16,7 +16,7 @@
 #define STRESSDIVERGENCEDAMPER_H
 
 #include "Kernel.h"
-#include "ColumnMajorMatrix.h"
+#include "StaticMatrix.h"
 
 class StressDivergenceDamper : public Kernel
 {
@@ -43,7 +43,11 @@ protected:
   const MaterialProperty<ColumnMajorMatrix> & _Fg;
 
   /// damper stiffness matrix in global coordinate system
-  const MaterialProperty<ColumnMajorMatrix> & _Kg;
+  const MaterialProperty<StaticMatrix<6, 6>> & _Kg;
+
+  /// whether this kernel assembles the residual and Jacobian of all the
+  /// displacement variables, instead of one kernel per component
+  const bool _assemble_all_components;
 };
 
 #endif // STRESSDIVERGENCEDAMPER_H
@@ -16,7 +16,7 @@
 #define STRESSDIVERGENCEISOLATOR_H
 
 #include "Kernel.h"
-#include "ColumnMajorMatrix.h"
+#include "StaticMatrix.h"
 
 class StressDivergenceIsolator : public Kernel
 {
@@ -30,6 +30,25 @@ public:
 protected:
   virtual Real computeQpResidual() override { return 0.0; }
 
+  /// Adds the residuals of all the coupled variables at once.
+  void computeElementResidual();
+
+  /// Adds the Jacobian blocks of all the pairs of coupled variables at once.
+  void computeElementJacobian();
+
+  /// Sets the coefficients of the current, old and older global forces in the
+  /// residual, which include the stiffness proportional Rayleigh damping and
+  /// the HHT time integration.
+  void computeForceCoefficients();
+
+  /// Entry i of the global forces in the residual, using the coefficients from
+  /// computeForceCoefficients.
+  Real globalForceResidual(const unsigned int i) const;
+
+  /// Scaling factor of the stiffness matrix in the Jacobian for the Rayleigh
+  /// damping and the HHT time integration.
+  Real jacobianScale() const;
+
   /// Direction along which force/moment is calculated
   const unsigned int _component;
 
@@ -49,7 +68,7 @@ protected:
   const MaterialProperty<ColumnMajorMatrix> & _Fg;
 
   /// GLobal stiffness matrix
-  const MaterialProperty<ColumnMajorMatrix> & _Kg;
+  const MaterialProperty<StaticMatrix<12, 12>> & _Kg;
 
   /// Stiffness proportional Rayleigh damping parameter
   const Real & _zeta;
@@ -68,6 +87,22 @@ protected:
 
   /// Static initialization
   const bool _static_initialization;
+
+  /// Whether this kernel assembles the residual and Jacobian of all the
+  /// displacement and rotation variables, instead of one kernel per component
+  const bool _assemble_all_components;
+
+  /// Variable numbers of the displacements followed by the rotations
+  std::vector<unsigned int> _all_var;
+
+  /// Direction of each variable in _all_var
+  std::vector<unsigned int> _all_component;
+
+  /// Whether the old and older forces are included in the current residual
+  bool _damped_residual;
+
+  /// Coefficients of the current, old and older global forces in the residual
+  Real _force_coef[3];
 };
 
 #endif // STRESSDIVERGENCEISOLATOR_H
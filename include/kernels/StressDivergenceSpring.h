@@ -16,6 +16,7 @@
 #define STRESSDIVERGENCESPRING_H
 
 #include "Kernel.h"
+#include "StaticMatrix.h"
 
 // Forward Declarations
 template <typename>
@@ -34,6 +35,12 @@ public:
 protected:
   virtual Real computeQpResidual() override { return 0.0; }
 
+  /// Residual at node 0 in the given direction
+  Real nodalResidual(const unsigned int component) const;
+
+  /// Diagonal entry of the stiffness matrix in the given direction
+  Real stiffness(const unsigned int component) const;
+
   /// Direction along which force/moment is calculated
   const unsigned int _component;
 
@@ -56,13 +63,23 @@ protected:
   const MaterialProperty<ColumnMajorMatrix> & _spring_moments_global;
 
   /// Displacement stiffness matrix
-  const MaterialProperty<ColumnMajorMatrix> & _kdd;
+  const MaterialProperty<StaticMatrix<3, 3>> & _kdd;
 
   /// Rotation stiffness matrix
-  const MaterialProperty<ColumnMajorMatrix> & _krr;
+  const MaterialProperty<StaticMatrix<3, 3>> & _krr;
 
   /// Rotation stiffness matrix
-  const MaterialProperty<ColumnMajorMatrix> & _total_global_to_local_rotation;
+  const MaterialProperty<StaticMatrix<3, 3>> & _total_global_to_local_rotation;
+
+  /// Whether this kernel assembles the residual and Jacobian of all the
+  /// displacement and rotation variables, instead of one kernel per component
+  const bool _assemble_all_components;
+
+  /// Variable numbers of the displacements followed by the rotations
+  std::vector<unsigned int> _all_var;
+
+  /// Direction of each variable in _all_var
+  std::vector<unsigned int> _all_component;
 };
 
 #endif // STRESSDIVERGENCESPRING_H
@@ -23,6 +23,9 @@
 
 #include "ADComputeFiniteStrainElasticStress.h"
 
+// Mastodon includes
+#include "ISoilUtils.h"
+
 class ADComputeISoilStress : public ADComputeFiniteStrainElasticStress
 {
 public:
@@ -39,21 +42,45 @@ protected:
   /// elastic-perfectly plastic stress strain curves.
   virtual void computeStress();
 
+  /// Calculates the total stress like computeStress, but with the derivatives
+  /// of the curve stresses taken with respect to the trial stress increment
+  /// only, which are then chained into the global derivatives of the total
+  /// stress.
+  void computeLocalStress(const ADReal & mean_stress);
+
   virtual void initQpStatefulProperties() override;
 
-  /// Deconstructs the backbone curve into a set of elastic-perfectly-plastic
-  /// curves, each comprising a Young's modulus and yield stress.
-  void computeSoilLayerProperties(std::vector<std::vector<ADReal>> & youngs,
-                                  std::vector<std::vector<ADReal>> & yield_stress,
-                                  const std::vector<std::vector<Real>> & backbone_stress,
-                                  const std::vector<std::vector<Real>> & backbone_strain,
-                                  const std::vector<unsigned int> & layer_ids,
-                                  const std::vector<Real> & poissons_ratio,
-                                  const std::string & name);
+  /// Sets _current_id and _pos from the layer variable at the current
+  /// quadrature point.
+  void updateLayerPosition();
+
+  /// Clears the cached layer position of each element.
+  virtual void meshChanged() override;
+
+  /// Young's moduli of the curves of the soil layer at position pos in
+  /// layer_ids.
+  const Real * layerYoungs(unsigned int pos) const
+  {
+    return &_layer_table->youngs[pos * _num_models];
+  }
+
+  /// Yield strains of the curves of the soil layer at position pos.
+  const Real * layerYieldStrains(unsigned int pos) const
+  {
+    return &_layer_table->yield_strain[pos * _num_models];
+  }
+
+  /// Computes the backbone curves of all the soil layers from the soil_type
+  /// parameters.
+  void computeBackbone(std::vector<std::vector<Real>> & backbone_stress,
+                       std::vector<std::vector<Real>> & backbone_strain);
 
   /// Base names given to each elastic perfectly plastic curve.
   std::vector<std::string> _base_models;
 
+  /// Number of elastic perfectly plastic curves.
+  std::size_t _num_models;
+
   /// Material property which stores the current stress for each elastic
   /// perfectly plastic curve.
   std::vector<ADMaterialProperty<RankTwoTensor> *> _stress_model;
@@ -62,12 +89,9 @@ protected:
   /// plastic curve.
   std::vector<const MaterialProperty<RankTwoTensor> *> _stress_model_old;
 
-  /// Yield stress for each elastic perfectly plastic curve for each soil layer.
-  std::vector<std::vector<ADReal>> _yield_stress;
-
-  /// Young's modulus for each elastic perfectly plastic curve for each soil
-  /// layer.
-  std::vector<std::vector<ADReal>> _youngs;
+  /// Young's moduli and yield strains of the curves of all the soil layers,
+  /// shared with the other materials that have the same backbone curves.
+  std::shared_ptr<const ISoilUtils::LayerTable> _layer_table;
 
   /// The coupled variable field providing the soil layer id.
   const VariableValue & _soil_layer_variable;
@@ -75,9 +99,25 @@ protected:
   /// The vector of soil layer ids.
   std::vector<unsigned int> _layer_ids;
 
+  /// Position in _layer_ids of each layer id, or Mastodon::INVALID_LAYER_ID
+  /// for the ids that are not in _layer_ids.
+  std::vector<unsigned int> _layer_id_to_index;
+
+  /// Whether the layer variable is constant on each element, in which case the
+  /// position of the layer of each element is cached.
+  const bool _constant_layer_variable;
+
+  /// Position in _layer_ids of the layer of each element, indexed by the
+  /// element id, or Mastodon::INVALID_LAYER_ID for the elements that have not
+  /// been visited yet.
+  std::vector<unsigned int> _element_layer_index;
+
   /// Flag to turn on/off P and S wave speed calculation
   bool _wave_speed_calculation;
 
+  /// Whether the curve stresses are computed with local derivatives.
+  const bool _local_derivatives;
+
   /// Poisson's ratio for each soil layer.
   const std::vector<Real> _poissons_ratio;
 
@@ -125,7 +165,7 @@ protected:
   ADMaterialProperty<Real> * _P_wave_speed;
 
   /// The position of the current layer id in the vector layer_ids.
-  int _pos;
+  unsigned int _pos;
 
   /// Whether initial stress was provided
   const bool _initial_soil_stress_provided;
@@ -16,7 +16,7 @@
 #define COMPUTEFPISOLATORELASTICITY_H
 
 #include "Material.h"
-#include "ColumnMajorMatrix.h"
+#include "StaticMatrix.h"
 
 /**
  * ComputeFPIsolatorElasticity calculates the forces and stiffness matrix
@@ -115,43 +115,43 @@ protected:
   Real _sD;
 
   /// Isolator deformations in the local system
-  const MaterialProperty<ColumnMajorMatrix> & _local_def;
+  const MaterialProperty<StaticMatrix<12, 1>> & _local_def;
 
   /// Isolator deformations in the basic system
   const MaterialProperty<ColumnMajorMatrix> & _basic_def;
 
   /// Isolator old deformations in the basic system
-  const MaterialProperty<ColumnMajorMatrix> & _basic_def_old;
+  const MaterialProperty<StaticMatrix<6, 1>> & _basic_def_old;
 
   /// Isolator deformation rates in the basic system
   const MaterialProperty<ColumnMajorMatrix> & _basic_vel;
 
   /// Isolator old deformation rates in the basic system
-  const MaterialProperty<ColumnMajorMatrix> & _basic_vel_old;
+  const MaterialProperty<StaticMatrix<6, 1>> & _basic_vel_old;
 
   /// Isolator forces (including moments) in the basic system
   MaterialProperty<ColumnMajorMatrix> & _Fb;
 
   /// Isolator forces (including moments) in the local system
-  MaterialProperty<ColumnMajorMatrix> & _Fl;
+  MaterialProperty<StaticMatrix<12, 1>> & _Fl;
 
   /// Isolator forces (including moments) in the global system
   MaterialProperty<ColumnMajorMatrix> & _Fg;
 
   /// Isolator stiffness (including rotational stiffness) in the basic system
-  MaterialProperty<ColumnMajorMatrix> & _Kb;
+  MaterialProperty<StaticMatrix<6, 6>> & _Kb;
 
   /// Isolator stiffness (including rotational stiffness) in the local system
-  MaterialProperty<ColumnMajorMatrix> & _Kl;
+  MaterialProperty<StaticMatrix<12, 12>> & _Kl;
 
   /// Isolator stiffness (including rotational stiffness) in the global system
-  MaterialProperty<ColumnMajorMatrix> & _Kg;
+  MaterialProperty<StaticMatrix<12, 12>> & _Kg;
 
   /// Transformation matrix from global coordinate system to isolator local configuration at any time
-  const MaterialProperty<ColumnMajorMatrix> & _total_gl;
+  const MaterialProperty<StaticMatrix<12, 12>> & _total_gl;
 
   /// Transformation matrix from isolator local coordinate system to basic configuration at any time
-  const MaterialProperty<ColumnMajorMatrix> & _total_lb;
+  const MaterialProperty<StaticMatrix<6, 12>> & _total_lb;
 
   /// Length of the bearing at t = 0
   const MaterialProperty<Real> & _length;
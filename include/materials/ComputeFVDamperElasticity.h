@@ -16,7 +16,7 @@
 #define COMPUTEFVDAMPERELASTICITY_H
 
 #include "Material.h"
-#include "ColumnMajorMatrix.h"
+#include "StaticMatrix.h"
 
 /**
  * ComputeFVDamperElasticity calculates the deformations,forces and stiffness matrix
@@ -106,8 +106,10 @@ protected:
   /// damper forces of the previous step in the basic coordinate system
   const MaterialProperty<Real> & _Fb_old;
 
-  /// damper forces in the local coordinate system
-  MaterialProperty<ColumnMajorMatrix> & _Fl;
+  /// damper forces in the local coordinate system. The local and global
+  /// matrices of the damper are named differently from those of the isolators,
+  /// which have other sizes, so that both elements can be used in one model.
+  MaterialProperty<StaticMatrix<2, 1>> & _Fl;
 
   /// damper forces in the global coordinate system
   MaterialProperty<ColumnMajorMatrix> & _Fg;
@@ -116,13 +118,13 @@ protected:
   MaterialProperty<Real> & _Kb;
 
   /// damper stiffness in the local coordinate system
-  MaterialProperty<ColumnMajorMatrix> & _Kl;
+  MaterialProperty<StaticMatrix<2, 2>> & _Kl;
 
   /// damper stiffness in the global coordinate system
-  MaterialProperty<ColumnMajorMatrix> & _Kg;
+  MaterialProperty<StaticMatrix<6, 6>> & _Kg;
 
   /// transformation matrix from global coordinate system to damper local configuration at any time
-  MaterialProperty<ColumnMajorMatrix> & _total_gl;
+  MaterialProperty<StaticMatrix<2, 6>> & _total_gl;
 };
 
 #endif // COMPUTEFVDAMPERELASTICITY_H
@@ -26,7 +26,9 @@
 #include "ComputeFiniteStrainElasticStress.h"
 
 // Mastodon includes
+#include "ISoilUtils.h"
 #include "LayeredMaterialInterface.h"
+#include "MastodonTypes.h"
 
 class ComputeISoilStress : public ComputeFiniteStrainElasticStress
 {
@@ -41,28 +43,90 @@ protected:
   /// elastic-perfectly plastic stress strain curves.
   virtual void computeStress();
 
+  /// Computes the consistent tangent of the return maps of all the elastic
+  /// perfectly plastic curves, after computeStress.
+  void computeConsistentTangent(const unsigned int active_models);
+
   virtual void initQpStatefulProperties() override;
 
+  /// Computes the backbone curves of all the soil layers from the soil_type
+  /// parameters.
+  void computeBackbone(std::vector<std::vector<Real>> & backbone_stress,
+                       std::vector<std::vector<Real>> & backbone_strain);
+
+  /// Computes the stiffness and strength pressure corrections of the current
+  /// layer for the given mean stress.
+  void computePressureCorrections(const Real mean_stress);
+
+  /// Sets _current_id and _pos from the layer variable at the current
+  /// quadrature point.
+  void updateLayerPosition();
+
+  /// Clears the cached layer position of each element.
+  virtual void meshChanged() override;
+
+  /// Young's moduli of the curves of the soil layer at position pos in
+  /// layer_ids.
+  const Real * layerYoungs(unsigned int pos) const
+  {
+    return &_layer_table->youngs[pos * _num_models];
+  }
+
+  /// Yield strains of the curves of the soil layer at position pos.
+  const Real * layerYieldStrains(unsigned int pos) const
+  {
+    return &_layer_table->yield_strain[pos * _num_models];
+  }
+
+  /// Sums of the Young's moduli of the curves from i to the last curve of the
+  /// soil layer at position pos, for i from 0 to _num_models.
+  const Real * layerYoungsTailSum(unsigned int pos) const
+  {
+    return &_layer_table->youngs_tail_sum[pos * (_num_models + 1)];
+  }
+
   /// Strain_increment for the current time step.
   const MaterialProperty<RankTwoTensor> & _strain_increment;
 
-  /// Base names given to each elastic perfectly plastic curve.
-  std::vector<std::string> _base_models;
+  /// Number of independent components of the deviatoric stress of an elastic
+  /// perfectly plastic curve, stored in the order xx, yy, xy, xz, yz. The
+  /// stress is symmetric and traceless, so zz = -(xx + yy).
+  static const unsigned int _num_components = 5;
 
-  /// Material property which stores the current stress for each elastic
-  /// perfectly plastic curve.
-  std::vector<MaterialProperty<RankTwoTensor> *> _stress_model;
+  /// Number of elastic perfectly plastic curves.
+  std::size_t _num_models;
 
-  /// Material property which stores the old stress for each elastic perfectly
-  /// plastic curve.
-  std::vector<const MaterialProperty<RankTwoTensor> *> _stress_model_old;
+  /// Material property which stores the current deviatoric stress of the
+  /// active elastic perfectly plastic curves as a structure of arrays:
+  /// component c of curve i is at c * _num_models + i. The last
+  /// _num_components entries are the deviatoric stress normalized by the
+  /// Young's modulus, which is the same for all the inactive curves. As long
+  /// as none of the curves has yielded, only these last entries are stored.
+  MaterialProperty<std::vector<Real>> & _stress_model;
 
-  /// Yield stress for each elastic perfectly plastic curve for each soil layer.
-  std::vector<std::vector<Real>> _yield_stress;
+  /// Material property which stores the old deviatoric stress of all the
+  /// elastic perfectly plastic curves.
+  const MaterialProperty<std::vector<Real>> & _stress_model_old;
 
-  /// Young's modulus for each elastic perfectly plastic curve for each soil
-  /// layer.
-  std::vector<std::vector<Real>> _youngs;
+  /// Number of active curves. The curves after these have never yielded.
+  MaterialProperty<unsigned int> & _active_models;
+
+  /// Old number of active curves.
+  const MaterialProperty<unsigned int> & _active_models_old;
+
+  /// Young's moduli and yield strains of the curves of all the soil layers,
+  /// shared with the other materials that have the same backbone curves. If
+  /// the yield strains of a layer do not increase with the curve index, all
+  /// the curves of the layer are kept active.
+  std::shared_ptr<const ISoilUtils::LayerTable> _layer_table;
+
+  /// Young's modulus of each curve that did not yield in the current step and
+  /// zero for the curves that yielded.
+  std::vector<Real> _elastic_youngs;
+
+  /// Factor by which the trial stress of each curve is scaled back to the
+  /// yield surface, which is one for the curves that did not yield.
+  std::vector<Real> _return_scale;
 
   /// The coupled variable field providing the soil layer id.
   const VariableValue & _soil_layer_variable;
@@ -70,6 +134,19 @@ protected:
   /// The vector of soil layer ids.
   std::vector<unsigned int> _layer_ids;
 
+  /// Position in _layer_ids of each layer id, or Mastodon::INVALID_LAYER_ID
+  /// for the ids that are not in _layer_ids.
+  std::vector<unsigned int> _layer_id_to_index;
+
+  /// Whether the layer variable is constant on each element, in which case the
+  /// position of the layer of each element is cached.
+  const bool _constant_layer_variable;
+
+  /// Position in _layer_ids of the layer of each element, indexed by the
+  /// element id, or Mastodon::INVALID_LAYER_ID for the elements that have not
+  /// been visited yet.
+  std::vector<unsigned int> _element_layer_index;
+
   /// Flag to turn on/off P and S wave speed calculation
   bool _wave_speed_calculation;
 
@@ -113,6 +190,26 @@ protected:
   /// The multiplicative factor for pressure dependent stiffness correction.
   Real _stiffness_pressure_correction;
 
+  /// Inverse of the reference pressure of each soil layer.
+  std::vector<Real> _inv_p_ref;
+
+  /// Inverse of the strength pressure correction term at the reference
+  /// pressure, 1 / sqrt(a0 + a1 * p_ref + a2 * p_ref^2), of each soil layer.
+  std::vector<Real> _inv_strength_reference;
+
+  /// Values of b_exp for which the stiffness pressure correction is computed
+  /// without pow.
+  enum class StiffnessExponent
+  {
+    ZERO,
+    HALF,
+    ONE,
+    GENERAL
+  };
+
+  /// How the stiffness pressure correction is computed for b_exp.
+  StiffnessExponent _stiffness_exponent;
+
   /// Computed shear wave speed.
   MaterialProperty<Real> * _shear_wave_speed;
 
@@ -123,7 +220,7 @@ protected:
   Real _tangent_modulus;
 
   /// The position of the current layer id in the vector layer_ids.
-  int _pos;
+  unsigned int _pos;
 
   /// Whether initial stress was provided
   const bool _initial_soil_stress_provided;
@@ -134,10 +231,6 @@ protected:
   /// The stress increment for one elastic perfectly plastic curve.
   RankTwoTensor _individual_stress_increment;
 
-  /// The deviatoric part of the trial stress for one elastic perfectly plastic
-  /// curve.
-  RankTwoTensor _deviatoric_trial_stress;
-
   /// The id to be used for looking up the shear modulus and density, it is
   /// declared once here and re-used rather
   /// than creating a temporary variable in computeQpProperties method, simply
@@ -153,17 +246,25 @@ protected:
   /// This is a temporary variable declared to avoid repetitive calculations.
   RankTwoTensor _deviatoric_trial_stress_tmp;
 
-  /// Square of the deviatoric trial stress.
-  Real _dev_trial_stress_squared;
+  /// initial stress components
+  std::vector<const Function *> _initial_soil_stress;
+
+  /// Whether the consistent tangent is used for the Jacobian.
+  const bool _consistent_tangent;
 
-  /// The effective trial stress.
-  Real _effective_trial_stress;
+  /// Sum of the Young's moduli of the curves, each scaled by its return map
+  /// factor, in the consistent tangent.
+  Real _tangent_scale;
 
-  /// The yield condition.
-  Real _yield_condition;
+  /// Sum of the 3/2 * E * y / |t| * n x n terms of the curves that yielded in
+  /// the consistent tangent.
+  RankFourTensor _tangent_correction;
 
-  /// initial stress components
-  std::vector<const Function *> _initial_soil_stress;
+  /// Projection onto the deviatoric part of a symmetric tensor.
+  RankFourTensor _deviatoric_projection;
+
+  /// Outer product of the identity with itself.
+  RankFourTensor _volumetric_projection;
 };
 
 #endif // COMPUTEISOILSTRESS_H
@@ -17,6 +17,10 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "StaticMatrix.h"
+
+#include <limits>
+
 /**
  * ComputeIsolatorDeformation calculates the deformations and rotations in a
  * isolator element.
@@ -39,6 +43,38 @@ protected:
   /// Computes the displacement and rotational deformations of the isolator
   void computeDeformation();
 
+  /// Clears the cached geometry of the elements.
+  virtual void meshChanged() override;
+
+  /// Orientation and length of an isolator element, which only depend on
+  /// the undeformed geometry, and the transformation from the global to the
+  /// basic system for the shear distance ratio sd_ratio.
+  struct ElementGeometry
+  {
+    /// Whether the orientation and length were computed
+    bool computed = false;
+
+    /// Rotation from the global to the local system, whose rows are the
+    /// local x, y and z axes
+    StaticMatrix<3, 3> rotation;
+
+    /// Initial length of the isolator
+    Real length = 0.0;
+
+    /// Shear distance ratio for which global_to_basic was computed
+    Real sd_ratio = std::numeric_limits<Real>::quiet_NaN();
+
+    /// Transformation from the global to the basic system
+    StaticMatrix<6, 12> global_to_basic;
+  };
+
+  /// Geometry of the current element, which is cached unless the material is
+  /// evaluated on the displaced mesh.
+  ElementGeometry & currentGeometry();
+
+  /// Computes the orientation and length of the current element.
+  void computeOrientation(ElementGeometry & geometry);
+
   /// Number of coupled rotational variables
   unsigned int _nrot;
 
@@ -61,31 +97,47 @@ protected:
   const MaterialProperty<Real> & _sD;
 
   /// Displacements in the isolator local system, namely, deformations
-  MaterialProperty<ColumnMajorMatrix> & _local_disp;
+  MaterialProperty<StaticMatrix<12, 1>> & _local_disp;
 
   /// Displacements in the isolator basic system, namely, deformations
   MaterialProperty<ColumnMajorMatrix> & _basic_disp;
 
   /// Displacements in the isolator basic system, namely, old deformations
-  MaterialProperty<ColumnMajorMatrix> & _basic_disp_old;
+  MaterialProperty<StaticMatrix<6, 1>> & _basic_disp_old;
 
   /// Velocities in the isolator basic system, namely, deformation rates
   MaterialProperty<ColumnMajorMatrix> & _basic_vel;
 
   /// Velocities in the isolator basic system, namely, old deformation rates
-  MaterialProperty<ColumnMajorMatrix> & _basic_vel_old;
+  MaterialProperty<StaticMatrix<6, 1>> & _basic_vel_old;
 
   /// Transformation matrix from global coordinate system to isolator local configuration at t=0
-  MaterialProperty<ColumnMajorMatrix> & _original_gl;
+  MaterialProperty<StaticMatrix<12, 12>> & _original_gl;
 
   /// Transformation matrix from global coordinate system to isolator local configuration at any time
-  MaterialProperty<ColumnMajorMatrix> & _total_gl;
+  MaterialProperty<StaticMatrix<12, 12>> & _total_gl;
 
   /// Transformation matrix from isolator local coordinate system to basic configuration at any time
-  MaterialProperty<ColumnMajorMatrix> & _total_lb;
+  MaterialProperty<StaticMatrix<6, 12>> & _total_lb;
 
   /// Initial length of the isolator
   MaterialProperty<Real> & _length;
+
+  /// Orientation of the local y axis in the global coordinate system
+  const RealGradient _y_orientation;
+
+  /// Whether the geometry of each element is cached, which is only possible
+  /// when the nodes do not move, i.e., on the undisplaced mesh
+  const bool _cache_geometry;
+
+  /// Cached geometry of each element, indexed by the element id
+  std::vector<ElementGeometry> _element_geometry;
+
+  /// Geometry of the current element when it is not cached
+  ElementGeometry _scratch_geometry;
+
+  /// Transformation from the global to the basic system of the current element
+  const StaticMatrix<6, 12> * _total_gb;
 };
 
 #endif // COMPUTEISOLATORDEFORMATION_H
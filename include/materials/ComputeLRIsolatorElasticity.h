@@ -16,7 +16,7 @@
 #define COMPUTELRISOLATORELASTICITY_H
 
 #include "Material.h"
-#include "ColumnMajorMatrix.h"
+#include "StaticMatrix.h"
 
 /**
  * ComputeLRIsolatorElasticity calculates the forces and stiffness matrix
@@ -44,8 +44,22 @@ protected:
   /// Computes the forces and stiffness matrix elements in shear
   void computeShear();
 
-  /// Computes the current temperature in the lead core
-  Real calculateCurrentTemperature(Real _qYield, Real _TLC, Real vel);
+  /// Solves the evolution equations of the hysteresis parameters, z, for the
+  /// shear deformation increments du1 and du2 with the Newton-Raphson method,
+  /// given the yield displacement uy. Sets tmp1 and tmp2 to the
+  /// beta + gamma * sign(z * du) terms used for the tangent, and returns the
+  /// number of iterations.
+  unsigned int
+  solveHysteresis(const Real uy, const Real du1, const Real du2, Real & tmp1, Real & tmp2);
+
+  /// Computes the current temperature in the lead core from the temperature
+  /// TLC at the time dt before the current time
+  Real calculateCurrentTemperature(Real qYield, Real TLC, Real dt, Real vel);
+
+  /// Heat conduction term, 1 / F + 1.274 * ((n - 1) * ts / a) * tau^(-1/3),
+  /// of the lead core at time t. The terms of the two times used in the
+  /// temperature update are cached, since they only depend on the time.
+  Real conductionTerm(const unsigned int i, const Real t);
 
   /// Changes the stiffness matrix in the local coordinate system by adding
   /// P-Delta effects
@@ -132,6 +146,22 @@ protected:
   /// Viscous damping parameter
   const Real & _cd;
 
+  /// Beta parameter of the hysteretic evolution (as per Nagarajaiah, 1991)
+  const Real _hysteresis_beta;
+
+  /// Gamma parameter of the hysteretic evolution (as per Nagarajaiah, 1991)
+  const Real _hysteresis_gamma;
+
+  /// Tolerance on the norm of the Newton-Raphson increment of z
+  const Real _hysteresis_tolerance;
+
+  /// Maximum number of Newton-Raphson iterations for z
+  const unsigned int _hysteresis_max_iterations;
+
+  /// Whether the Newton-Raphson iterations for z start from the value
+  /// extrapolated with the rate of the previous time step
+  const bool _hysteresis_predictor;
+
   /// Shear distance ratio
   Real _sD;
 
@@ -139,13 +169,13 @@ protected:
   const MaterialProperty<ColumnMajorMatrix> & _basic_def;
 
   /// Isolator old deformations in the basic system
-  const MaterialProperty<ColumnMajorMatrix> & _basic_def_old;
+  const MaterialProperty<StaticMatrix<6, 1>> & _basic_def_old;
 
   /// Isolator deformation rates in the basic system
   const MaterialProperty<ColumnMajorMatrix> & _basic_vel;
 
   /// Isolator old deformations rates in the basic system
-  const MaterialProperty<ColumnMajorMatrix> & _basic_vel_old;
+  const MaterialProperty<StaticMatrix<6, 1>> & _basic_vel_old;
 
   /// Isolator forces (including moments) in the basic system
   MaterialProperty<ColumnMajorMatrix> & _Fb;
@@ -154,25 +184,25 @@ protected:
   const MaterialProperty<ColumnMajorMatrix> & _Fb_old;
 
   /// Isolator forces (including moments) in the local system
-  MaterialProperty<ColumnMajorMatrix> & _Fl;
+  MaterialProperty<StaticMatrix<12, 1>> & _Fl;
 
   /// Isolator forces (including moments) in the global system
   MaterialProperty<ColumnMajorMatrix> & _Fg;
 
   /// Isolator stiffness (including rotational stiffness) in the basic system
-  MaterialProperty<ColumnMajorMatrix> & _Kb;
+  MaterialProperty<StaticMatrix<6, 6>> & _Kb;
 
   /// Isolator stiffness (including rotational stiffness) in the local system
-  MaterialProperty<ColumnMajorMatrix> & _Kl;
+  MaterialProperty<StaticMatrix<12, 12>> & _Kl;
 
   /// Isolator stiffness (including rotational stiffness) in the global system
-  MaterialProperty<ColumnMajorMatrix> & _Kg;
+  MaterialProperty<StaticMatrix<12, 12>> & _Kg;
 
   /// Transformation matrix from global coordinate system to isolator local configuration at any time
-  const MaterialProperty<ColumnMajorMatrix> & _total_gl;
+  const MaterialProperty<StaticMatrix<12, 12>> & _total_gl;
 
   /// Transformation matrix from isolator local coordinate system to basic configuration at any time
-  const MaterialProperty<ColumnMajorMatrix> & _total_lb;
+  const MaterialProperty<StaticMatrix<6, 12>> & _total_lb;
 
   /// Length of the bearing at t = 0
   const MaterialProperty<Real> & _length;
@@ -249,35 +279,72 @@ protected:
   /// Committed lead temperature
   Real _TLC;
 
+  /// Whether the lead temperature is stored for each element and committed
+  /// at the end of each time step
+  const bool _stateful_lead_temperature;
+
+  /// Lead temperature of each element
+  MaterialProperty<Real> * _lead_temperature;
+
+  /// Lead temperature of each element at the end of the previous time step
+  const MaterialProperty<Real> * _lead_temperature_old;
+
+  /// Radius of the lead core
+  Real _a_lead;
+
+  /// Square of the radius of the lead core
+  Real _a_lead2;
+
+  /// Area of the lead core
+  Real _area_lead;
+
+  /// Heat capacity of the lead core per unit area, rho_lead * c_lead * h
+  Real _heat_capacity_lead;
+
+  /// Conduction factor of the steel shims, 1.274 * (n - 1) * ts / a
+  Real _shim_conduction;
+
+  /// Times at which the cached conduction terms were computed
+  Real _conduction_time[2];
+
+  /// Cached conduction terms
+  Real _conduction_term[2];
+
   /// Hysteresis parameters
-  MaterialProperty<ColumnMajorMatrix> & _z;
+  MaterialProperty<StaticMatrix<2, 1>> & _z;
 
   /// old hysteresis parameters
-  const MaterialProperty<ColumnMajorMatrix> & _z_old;
+  const MaterialProperty<StaticMatrix<2, 1>> & _z_old;
+
+  /// older hysteresis parameters, only used by the predictor
+  const MaterialProperty<StaticMatrix<2, 1>> * _z_older;
+
+  /// Number of Newton-Raphson iterations for the hysteresis parameters
+  MaterialProperty<Real> & _hysteresis_iterations;
 
   /// Maximum tensile deformation (will be updated each time step)
-  MaterialProperty<ColumnMajorMatrix> & _umax;
+  MaterialProperty<StaticMatrix<1, 1>> & _umax;
 
   /// Maximum tensile deformation in the previous step
-  const MaterialProperty<ColumnMajorMatrix> & _umax_old;
+  const MaterialProperty<StaticMatrix<1, 1>> & _umax_old;
 
   /// current value of deformation that initiates cavitation (will be updated each time step)
-  MaterialProperty<ColumnMajorMatrix> & _ucn;
+  MaterialProperty<StaticMatrix<1, 1>> & _ucn;
 
   /// current value of deformation that initiates cavitation in previous step (will be updated each time step)
-  const MaterialProperty<ColumnMajorMatrix> & _ucn_old;
+  const MaterialProperty<StaticMatrix<1, 1>> & _ucn_old;
 
   /// Initial value of critical buckling load during loading
-  MaterialProperty<ColumnMajorMatrix> & _Fcrmin;
+  MaterialProperty<StaticMatrix<1, 1>> & _Fcrmin;
 
   /// Initial value of critical buckling load during loading in previous step
-  const MaterialProperty<ColumnMajorMatrix> & _Fcrmin_old;
+  const MaterialProperty<StaticMatrix<1, 1>> & _Fcrmin_old;
 
   /// Tangent matrix of hysteretic evolution parameters
-  ColumnMajorMatrix _dzdu;
+  StaticMatrix<2, 2> _dzdu;
 
   /// Committed displacements in the basic system
-  ColumnMajorMatrix _ubC;
+  StaticMatrix<6, 1> _ubC;
 
   /// Time at which variables are committed
   Real _tC;
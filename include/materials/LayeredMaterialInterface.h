@@ -42,6 +42,11 @@ public:
    */
   virtual void computeProperties() override;
 
+  /**
+   * Clears the cached layer of each element.
+   */
+  virtual void meshChanged() override;
+
   /*
    * Add a vector of data that corresponds with the "layer_ids" parameter.
    * @param data A reference to a vector of data to correspond with layer id
@@ -98,6 +103,23 @@ private:
   /// returning the MooseArray reference (see addLayerVector).
   std::vector<std::shared_ptr<LayerParameterBase>> _layer_data;
 
+  /// Returns the index in the input parameter data for the layer variable
+  /// value at the given quadrature point.
+  unsigned int layerParamIndex(unsigned int qp) const;
+
+  /// Whether the layer variable is constant on each element, in which case the
+  /// index in the input parameter data is cached for each element.
+  const bool _constant_layer_variable;
+
+  /// Index in the input parameter data of each element, indexed by the
+  /// element id. The entries are filled as the elements are visited, after the
+  /// initial setup when the layer variable has been computed.
+  std::vector<unsigned int> _element_param_index;
+
+  /// Index in the input parameter data at each quadrature point of the current
+  /// element.
+  std::vector<unsigned int> _qp_param_index;
+
 protected:
   /// The current "layer id" to be used for looking up the parameters.
   const MooseArray<unsigned int> & _layer_id;
@@ -108,6 +130,7 @@ LayeredMaterialInterface<T>::LayeredMaterialInterface(const InputParameters & pa
   : T(parameters),
     _layer_variable(T::coupledValue("layer_variable")),
     _input_layer_ids(T::template getParam<std::vector<unsigned int>>("layer_ids")),
+    _constant_layer_variable(T::getFieldVar("layer_variable", 0)->feType().order == CONSTANT),
     _layer_id(getLayerParam<unsigned int>("layer_ids"))
 {
   if (!dynamic_cast<Material *>(this))
@@ -129,36 +152,72 @@ LayeredMaterialInterface<T>::computeProperties()
   // Number of quadrature points
   auto n = _layer_variable.size();
 
+  // The location of the data in parameter data for each quadrature point. If
+  // the layer variable is constant on the element, the location is looked up
+  // once and cached for the element.
+  _qp_param_index.resize(n);
+  if (_constant_layer_variable && n > 0)
+  {
+    unsigned int idx;
+    if (T::_t_step > 0)
+    {
+      const dof_id_type elem_id = T::_current_elem->id();
+      if (elem_id >= _element_param_index.size())
+        _element_param_index.resize(T::_mesh.maxElemId(), Mastodon::INVALID_LAYER_ID);
+      if (_element_param_index[elem_id] == Mastodon::INVALID_LAYER_ID)
+        _element_param_index[elem_id] = layerParamIndex(0);
+      idx = _element_param_index[elem_id];
+    }
+    else
+      idx = layerParamIndex(0);
+    std::fill(_qp_param_index.begin(), _qp_param_index.end(), idx);
+  }
+  else
+    for (unsigned int qp = 0; qp < n; ++qp)
+      _qp_param_index[qp] = layerParamIndex(qp);
+
   for (auto & data : _layer_data)
   {
     // Resize the MooseArray
     data->resize(n);
 
+    // Update the reference data for the current quadrature point and layer id
     for (unsigned int qp = 0; qp < n; ++qp)
-    {
-      // The current "layer id"
-      unsigned int current_layer_id = static_cast<unsigned int>(std::round(_layer_variable[qp]));
-
-      // The location of the data in parameter data (i.e., data.second)
-      const unsigned int & idx = _layer_id_to_param_index[current_layer_id];
-      if (idx == Mastodon::INVALID_LAYER_ID)
-        mooseError("The current layer id variable value (",
-                   current_layer_id,
-                   ") was not provided in the 'layer_ids' parameter of the \"",
-                   T::name(),
-                   "\" block.");
-
-      // Update the reference data for the current quadrature point and layer id
-      //    qp = The current quadrature point
-      //    idx: The location in the input vectors given the current layer id
-      data->reinit(qp, idx);
-    }
+      data->reinit(qp, _qp_param_index[qp]);
   }
 
   // Call the base method
   T::computeProperties();
 }
 
+template <class T>
+void
+LayeredMaterialInterface<T>::meshChanged()
+{
+  _element_param_index.clear();
+  T::meshChanged();
+}
+
+template <class T>
+unsigned int
+LayeredMaterialInterface<T>::layerParamIndex(unsigned int qp) const
+{
+  // The current "layer id"
+  unsigned int current_layer_id = static_cast<unsigned int>(std::round(_layer_variable[qp]));
+
+  // The location of the data in parameter data (i.e., data.second)
+  const unsigned int idx = current_layer_id < _layer_id_to_param_index.size()
+                               ? _layer_id_to_param_index[current_layer_id]
+                               : Mastodon::INVALID_LAYER_ID;
+  if (idx == Mastodon::INVALID_LAYER_ID)
+    mooseError("The current layer id variable value (",
+               current_layer_id,
+               ") was not provided in the 'layer_ids' parameter of the \"",
+               T::name(),
+               "\" block.");
+  return idx;
+}
+
 template <class T>
 template <typename P>
 const MooseArray<P> &
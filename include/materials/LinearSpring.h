@@ -17,6 +17,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "StaticMatrix.h"
 
 /**
  * LinearSpring material simulates a linear spring with a diagonal stiffness
@@ -88,40 +89,40 @@ protected:
   const VariableValue & _krz;
 
   /// Global displacement at node 0 of the spring element
-  ColumnMajorMatrix _global_disp0; // node 0
+  StaticMatrix<3, 1> _global_disp0; // node 0
 
   /// Global displacement at node 1 of the spring element
-  ColumnMajorMatrix _global_disp1; // node 1
+  StaticMatrix<3, 1> _global_disp1; // node 1
 
   /// Global rotation at node 0 of the spring element
-  ColumnMajorMatrix _global_rot0; // node 0
+  StaticMatrix<3, 1> _global_rot0; // node 0
 
   /// Global rotation at node 1 of the spring element
-  ColumnMajorMatrix _global_rot1; // node 1
+  StaticMatrix<3, 1> _global_rot1; // node 1
 
   /// Local displacement at node 0 of the spring element
-  ColumnMajorMatrix _local_disp0; // node 0
+  StaticMatrix<3, 1> _local_disp0; // node 0
 
   /// Local displacement at node 1 of the spring element
-  ColumnMajorMatrix _local_disp1; // node 1
+  StaticMatrix<3, 1> _local_disp1; // node 1
 
   /// Local rotation at node 0 of the spring element
-  ColumnMajorMatrix _local_rot0; // node 0
+  StaticMatrix<3, 1> _local_rot0; // node 0
 
   /// Local rotation at node 1 of the spring element
-  ColumnMajorMatrix _local_rot1; // node 1
+  StaticMatrix<3, 1> _local_rot1; // node 1
 
   /// Spring forces in the local coordinate system
-  ColumnMajorMatrix _spring_forces_local;
+  StaticMatrix<3, 1> _spring_forces_local;
 
   // Spring moments in the local coordinate system
-  ColumnMajorMatrix _spring_moments_local;
+  StaticMatrix<3, 1> _spring_moments_local;
 
   /// Spring displacement stiffness matrix in the local coordinate system
-  ColumnMajorMatrix _kdd_local;
+  StaticMatrix<3, 3> _kdd_local;
 
   /// Spring rotational stiffness matrix in the local coordinate system
-  ColumnMajorMatrix _krr_local;
+  StaticMatrix<3, 3> _krr_local;
 
   /// Spring forces in the global coordinate system
   MaterialProperty<ColumnMajorMatrix> & _spring_forces_global;
@@ -130,16 +131,16 @@ protected:
   MaterialProperty<ColumnMajorMatrix> & _spring_moments_global;
 
   /// Spring displacement stiffness matrix in the global coordinate system
-  MaterialProperty<ColumnMajorMatrix> & _kdd;
+  MaterialProperty<StaticMatrix<3, 3>> & _kdd;
 
   /// Spring rotational stiffness matrix in the global coordinate system
-  MaterialProperty<ColumnMajorMatrix> & _krr;
+  MaterialProperty<StaticMatrix<3, 3>> & _krr;
 
   /// Rotational transformation from global coordinate system to spring local configuration at t = 0
-  ColumnMajorMatrix _original_global_to_local_rotation;
+  StaticMatrix<3, 3> _original_global_to_local_rotation;
 
   /// Rotational transformation from global coordinate system to spring local configuration at any time
-  MaterialProperty<ColumnMajorMatrix> & _total_global_to_local_rotation;
+  MaterialProperty<StaticMatrix<3, 3>> & _total_global_to_local_rotation;
 };
 
 #endif // LINEARSPRING_H
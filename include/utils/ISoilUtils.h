@@ -26,6 +26,10 @@
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 
+// STL includes
+#include <functional>
+#include <memory>
+
 // Forward declarations
 namespace ISoilUtils
 {
@@ -84,6 +88,47 @@ void computeCoulombBackbone(std::vector<std::vector<Real>> & backbone_stress,
                             const std::vector<Real> & hardening_ratio,
                             const std::vector<Real> & p_ref,
                             const std::string & name);
+
+/**
+ * The elastic perfectly plastic curves of all the soil layers of an I-Soil
+ * material, stored layer after layer. The tables are shared read-only by all
+ * the materials in the process that use the same backbone curves.
+ */
+struct LayerTable
+{
+  /// Number of elastic perfectly plastic curves of each layer.
+  std::size_t num_models;
+
+  /// Young's modulus of each curve.
+  std::vector<Real> youngs;
+
+  /// Yield strain of each curve.
+  std::vector<Real> yield_strain;
+
+  /// Sum of the Young's moduli of the curves from i to the last curve, for i
+  /// from 0 to num_models, for each layer.
+  std::vector<Real> youngs_tail_sum;
+
+  /// Whether the yield strains increase with the curve index, for each layer.
+  std::vector<bool> nested_yield;
+};
+
+/// Appends the values to the key that identifies a layer table. The size is
+/// appended first, so that the boundaries between the values are part of the
+/// key.
+void appendLayerTableKey(std::string & key, const std::vector<Real> & values);
+void appendLayerTableKey(std::string & key, const std::vector<std::string> & values);
+
+/// Returns the layer table identified by key and the Poisson's ratios. The
+/// table is built the first time it is requested in the process, from the
+/// backbone curves computed by compute_backbone, and is reused afterwards.
+std::shared_ptr<const LayerTable> getLayerTable(
+    std::string key,
+    const std::function<void(std::vector<std::vector<Real>> & backbone_stress,
+                             std::vector<std::vector<Real>> & backbone_strain)> & compute_backbone,
+    const std::vector<unsigned int> & layer_ids,
+    const std::vector<Real> & poissons_ratio,
+    const std::string & name);
 }
 
 #endif // ISOILUTILS_H
@@ -15,22 +15,45 @@
 #ifndef MASTODONUTILS_H
 #define MASTODONUTILS_H
 
+// STL includes
+#include <complex>
+
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 
+// MASTODON includes
+#include "SpectrumOscillatorBank.h"
+
 // Forward Declarations
 namespace MastodonUtils
 {
 /**
  *  The responseSpectrum function calculates the response spectrum for a
- *  given acceleration history.
+ *  given acceleration history with a constant time step, reg_dt. The
+ *  oscillators are integrated with the Newmark average-acceleration scheme by
+ *  default, or with the piecewise-exact scheme.
+ */
+std::vector<std::vector<Real>>
+responseSpectrum(const Real & freq_start,
+                 const Real & freq_end,
+                 const unsigned int & freq_num,
+                 const StridedArray & history_acc,
+                 const Real & xi,
+                 const Real & reg_dt,
+                 const SpectrumOscillatorBank::Integration integration =
+                     SpectrumOscillatorBank::NEWMARK);
+
+/**
+ *  Calculates the response spectrum for a given acceleration history with
+ *  a variable time step using the piecewise-exact scheme, without
+ *  regularizing the history.
  */
 std::vector<std::vector<Real>> responseSpectrum(const Real & freq_start,
                                                 const Real & freq_end,
                                                 const unsigned int & freq_num,
-                                                const std::vector<Real> & history_acc,
-                                                const Real & xi,
-                                                const Real & reg_dt);
+                                                const StridedArray & history_acc,
+                                                const StridedArray & history_time,
+                                                const Real & xi);
 
 /**
  *  The regularize function inputs a vector or a vector of vectors (with the
@@ -41,6 +64,66 @@ std::vector<std::vector<Real>> regularize(const std::vector<Real> & history_acc,
                                           const std::vector<Real> & history_time,
                                           const Real & reg_dt);
 
+/**
+ *  Regularizes history_acc to a constant dt, reg_dt, and writes the result
+ *  into reg_acc and, if provided, the corresponding time values into
+ *  reg_time. The output vectors are resized to the number of regularized
+ *  samples, so their memory is reused when they are passed again.
+ */
+void regularize(const std::vector<Real> & history_acc,
+                const std::vector<Real> & history_time,
+                const Real & reg_dt,
+                std::vector<Real> & reg_acc,
+                std::vector<Real> * reg_time = nullptr);
+
+/**
+ *  Same as the above, for histories that are not stored contiguously, such
+ *  as the columns of a binary response history file.
+ */
+void regularize(const StridedArray & history_acc,
+                const StridedArray & history_time,
+                const Real & reg_dt,
+                std::vector<Real> & reg_acc,
+                std::vector<Real> * reg_time = nullptr);
+
+/**
+ *  Returns an upper bound for the number of samples produced by regularize.
+ */
+std::size_t regularizedSize(const StridedArray & history_time, const Real & reg_dt);
+
+/**
+ *  Checks if the time vector is already spaced uniformly at reg_dt, in which
+ *  case the history can be used without regularizing it.
+ */
+bool isUniform(const StridedArray & history_time, const Real & reg_dt);
+
+/**
+ *  Computes the discrete Fourier transform of a real signal using a radix-2
+ *  FFT. The signal is zero padded to the next power of two, N, and the N/2+1
+ *  non-negative frequency coefficients are returned.
+ */
+std::vector<std::complex<Real>> realFFT(const std::vector<Real> & signal);
+
+/**
+ *  Calculates the Fourier amplitude spectrum and the one-sided power spectral
+ *  density of a history with a constant time step, dt. Returns the vectors of
+ *  frequency, Fourier amplitude and power spectral density. The power spectral
+ *  density is normalized by the number of samples in the record, num_samples,
+ *  which defaults to the size of the history, so that it integrates to the
+ *  mean square of the record regardless of any zero padding.
+ */
+std::vector<std::vector<Real>> fourierSpectrum(const std::vector<Real> & history,
+                                               const Real & dt,
+                                               const std::size_t num_samples = 0);
+
+/**
+ *  Smooths a spectrum using the Konno-Ohmachi window with the given bandwidth
+ *  coefficient, b. The frequencies must be in increasing order.
+ */
+std::vector<Real> konnoOhmachiSmoothing(const std::vector<Real> & freq,
+                                        const std::vector<Real> & spectrum,
+                                        const Real & bandwidth);
+
 /**
  * Function to check if all the vectors in a vector are of equal size
  */
@@ -0,0 +1,131 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef RESPONSEHISTORYFILE_H
+#define RESPONSEHISTORYFILE_H
+
+// STL includes
+#include <cstdint>
+#include <fstream>
+
+// MASTODON includes
+#include "StridedArray.h"
+
+/**
+ * Binary response history files store a table of doubles, with one row per
+ * time step and one column per history, in the native byte order. The file
+ * starts with a header containing:
+ *   - the 8 character identifier MSTDNRHB,
+ *   - the format version and the number of columns (uint32 each),
+ *   - the offset of the first row from the start of the file (uint64),
+ *   - the name of each column as its length (uint32) followed by the
+ *     characters,
+ * and is zero padded up to the first row, which is aligned to 8 bytes. Rows
+ * are appended in place as the simulation advances, so that the file does
+ * not need to be rewritten.
+ */
+namespace ResponseHistoryFileFormat
+{
+const char identifier[] = "MSTDNRHB";
+const uint32_t version = 1;
+}
+
+/**
+ * Writes a binary response history file one row at a time.
+ */
+class ResponseHistoryFileWriter
+{
+public:
+  /// Creates the file, overwriting any existing file, and writes the header.
+  ResponseHistoryFileWriter(const std::string & filename,
+                            const std::vector<std::string> & column_names);
+
+  /// Reopens an existing file with the same columns to append rows to it,
+  /// after discarding the rows at or after resume_time, which is used when a
+  /// simulation is restarted or recovered.
+  ResponseHistoryFileWriter(const std::string & filename,
+                            const std::vector<std::string> & column_names,
+                            const Real resume_time);
+
+  /// Appends a row, which must have one value per column, and flushes it to
+  /// the file so that it can be read while the simulation is running.
+  void appendRow(const std::vector<Real> & row);
+
+protected:
+  /// Name of the file.
+  const std::string _filename;
+
+  /// Number of columns.
+  const std::size_t _num_columns;
+
+  /// Output stream.
+  std::ofstream _stream;
+};
+
+/**
+ * Provides read-only access to a binary response history file by mapping it
+ * into memory. The columns are returned as views into the mapped file, so no
+ * data is copied.
+ */
+class ResponseHistoryFile
+{
+public:
+  ResponseHistoryFile(const std::string & filename);
+  ~ResponseHistoryFile();
+
+  ResponseHistoryFile(const ResponseHistoryFile &) = delete;
+  ResponseHistoryFile & operator=(const ResponseHistoryFile &) = delete;
+
+  /// Names of the columns.
+  const std::vector<std::string> & columnNames() const { return _column_names; }
+
+  /// Number of complete rows in the file.
+  std::size_t numRows() const { return _num_rows; }
+
+  /// Offset of the first row from the start of the file.
+  std::size_t rowsOffset() const
+  {
+    return reinterpret_cast<const char *>(_rows) - static_cast<const char *>(_map);
+  }
+
+  /// Index of the column with the given name.
+  std::size_t columnIndex(const std::string & name) const;
+
+  /// View of the i-th column.
+  StridedArray column(const std::size_t i) const;
+
+  /// View of the column with the given name.
+  StridedArray column(const std::string & name) const { return column(columnIndex(name)); }
+
+protected:
+  /// Name of the file.
+  const std::string _filename;
+
+  /// Names of the columns.
+  std::vector<std::string> _column_names;
+
+  /// Number of complete rows in the file.
+  std::size_t _num_rows;
+
+  /// Start of the memory mapped file.
+  void * _map;
+
+  /// Size of the memory mapped file.
+  std::size_t _map_size;
+
+  /// First value of the first row.
+  const Real * _rows;
+};
+
+#endif // RESPONSEHISTORYFILE_H
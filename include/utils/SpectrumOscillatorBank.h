@@ -0,0 +1,157 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef SPECTRUMOSCILLATORBANK_H
+#define SPECTRUMOSCILLATORBANK_H
+
+// MASTODON includes
+#include "StridedArray.h"
+
+/**
+ * SpectrumOscillatorBank stores a set of damped single degree of freedom
+ * oscillators, one for each frequency of a response spectrum, in a
+ * structure-of-arrays layout. All the oscillators are advanced together one
+ * acceleration sample at a time, so that the inner loop over the frequencies
+ * is free of branches and dependencies and can be vectorized by the compiler.
+ * Two integration schemes are available: the Newmark average-acceleration
+ * scheme and the piecewise-exact scheme of Nigam and Jennings (1969), which
+ * is exact for ground accelerations that vary linearly within a time step.
+ * The coefficients of both schemes are computed once for each frequency.
+ */
+class SpectrumOscillatorBank
+{
+public:
+  /// Time integration schemes for the oscillators.
+  enum Integration
+  {
+    NEWMARK,
+    PIECEWISE_EXACT
+  };
+
+  /**
+   * Creates freq_num oscillators with frequencies distributed uniformly in
+   * the log scale between freq_start and freq_end, damping ratio xi, and a
+   * constant time step dt. For the piecewise-exact scheme, dt may be zero
+   * when the samples are only advanced with their time values.
+   */
+  SpectrumOscillatorBank(const Real & freq_start,
+                         const Real & freq_end,
+                         const unsigned int & freq_num,
+                         const Real & xi,
+                         const Real & dt,
+                         const Integration integration = NEWMARK);
+
+  /// Brings all the oscillators back to rest and clears the peak responses.
+  void reset();
+
+  /// Advances all the oscillators through n ground acceleration samples that
+  /// are spaced at the constant time step.
+  void advance(const Real * history_acc, const std::size_t n);
+
+  /// Advances all the oscillators through n ground acceleration samples at
+  /// the given times, which need not be uniformly spaced. Only available for
+  /// the piecewise-exact scheme.
+  void advance(const Real * history_acc, const Real * history_time, const std::size_t n);
+
+  /// Same as the above, for samples that are not stored contiguously.
+  void advance(const StridedArray & history_acc);
+  void advance(const StridedArray & history_acc, const StridedArray & history_time);
+
+  /// Frequencies of the oscillators.
+  const std::vector<Real> & frequencies() const { return _freq; }
+
+  /// Periods of the oscillators.
+  const std::vector<Real> & periods() const { return _per; }
+
+  /// Natural circular frequencies of the oscillators.
+  const std::vector<Real> & circularFrequencies() const { return _om_n; }
+
+  /// Peak (spectral) displacement of each oscillator.
+  const std::vector<Real> & peakDisplacements() const { return _pdmax; }
+
+  /// Computes the displacement, pseudo velocity and pseudo acceleration
+  /// spectra from the peak displacements of the oscillators.
+  void spectrum(std::vector<Real> & dspec,
+                std::vector<Real> & vspec,
+                std::vector<Real> & aspec) const;
+
+protected:
+  /// Advances the oscillators with the Newmark scheme.
+  void advanceNewmark(const StridedArray & history_acc, const std::size_t n);
+
+  /// Advances the oscillators with the piecewise-exact scheme using the
+  /// current coefficients. The first sample must already have been processed.
+  void advanceExact(const StridedArray & history_acc, const std::size_t n);
+
+  /// Computes the piecewise-exact coefficients for the time step dt.
+  void computeExactCoefficients(const Real & dt);
+
+  /// Damping ratio of the oscillators.
+  const Real _xi;
+
+  /// Time integration scheme.
+  const Integration _integration;
+
+  /// Time step of the acceleration samples.
+  const Real _dt;
+
+  /// Frequencies of the oscillators.
+  std::vector<Real> _freq;
+
+  /// Periods of the oscillators.
+  std::vector<Real> _per;
+
+  /// Natural circular frequency, om_n = 2*pi*f, for each oscillator.
+  std::vector<Real> _om_n;
+
+  /// Coefficient of the displacement in the displacement update.
+  std::vector<Real> _c_dis;
+
+  /// Coefficient of the velocity in the displacement update.
+  std::vector<Real> _c_vel;
+
+  /// Effective stiffness, kd, of each oscillator.
+  std::vector<Real> _kd;
+
+  /// Piecewise-exact coefficients of each oscillator, such that
+  /// {dis, vel}_(i+1) = A {dis, vel}_i + B {acc_g_i, acc_g_(i+1)}.
+  std::vector<Real> _a11, _a12, _a21, _a22, _b11, _b12, _b21, _b22;
+
+  /// Time step for which the piecewise-exact coefficients were computed.
+  Real _exact_dt;
+
+  /// Current relative displacement of each oscillator.
+  std::vector<Real> _dis;
+
+  /// Current relative velocity of each oscillator.
+  std::vector<Real> _vel;
+
+  /// Current relative acceleration of each oscillator.
+  std::vector<Real> _acc;
+
+  /// Peak absolute relative displacement of each oscillator.
+  std::vector<Real> _pdmax;
+
+  /// Ground acceleration of the last sample processed.
+  Real _prev_ground_acc;
+
+  /// Time of the last sample processed, when the samples are advanced with
+  /// their time values.
+  Real _prev_time;
+
+  /// True once the first acceleration sample has been processed.
+  bool _started;
+};
+
+#endif // SPECTRUMOSCILLATORBANK_H
@@ -0,0 +1,183 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef STATICMATRIX_H
+#define STATICMATRIX_H
+
+// MOOSE includes
+#include "ColumnMajorMatrix.h"
+#include "DataIO.h"
+
+/**
+ * StaticMatrix is an M x N matrix with column major storage whose size is
+ * known at compile time. It is used for the small matrices of the link
+ * elements (isolators, dampers and springs), which are stored as material
+ * properties and multiplied at every evaluation. Unlike ColumnMajorMatrix, it
+ * does not allocate memory and the loops of its products have fixed bounds.
+ * The products sum the terms in the same order as ColumnMajorMatrix, so that
+ * both give the same results. The properties that are output with
+ * MaterialRealCMMAux, such as the basic deformations and forces, remain
+ * ColumnMajorMatrix properties.
+ */
+template <unsigned int M, unsigned int N>
+class StaticMatrix
+{
+public:
+  /// Creates a matrix of zeros.
+  StaticMatrix() { zero(); }
+
+  /// Copies a ColumnMajorMatrix of the same size.
+  explicit StaticMatrix(const ColumnMajorMatrix & rhs)
+  {
+    mooseAssert(rhs.m() == M && rhs.n() == N, "The sizes of the matrices must be the same.");
+    for (unsigned int i = 0; i < M * N; ++i)
+      _values[i] = rhs(i);
+  }
+
+  /// Number of rows.
+  static constexpr unsigned int m() { return M; }
+
+  /// Number of columns.
+  static constexpr unsigned int n() { return N; }
+
+  /// Entry in row i and column j.
+  Real & operator()(const unsigned int i, const unsigned int j) { return _values[j * M + i]; }
+  Real operator()(const unsigned int i, const unsigned int j) const { return _values[j * M + i]; }
+
+  /// Entry i in column major order, which is row i of a column vector.
+  Real & operator()(const unsigned int i) { return _values[i]; }
+  Real operator()(const unsigned int i) const { return _values[i]; }
+
+  /// Sets all the entries to zero.
+  void zero()
+  {
+    for (unsigned int i = 0; i < M * N; ++i)
+      _values[i] = 0.0;
+  }
+
+  /// Sets the matrix to the identity.
+  void identity()
+  {
+    static_assert(M == N, "Only a square matrix can be set to the identity.");
+    zero();
+    for (unsigned int i = 0; i < M; ++i)
+      _values[i * M + i] = 1.0;
+  }
+
+  /// Transpose of the matrix.
+  StaticMatrix<N, M> transpose() const
+  {
+    StaticMatrix<N, M> ret;
+    for (unsigned int i = 0; i < M; ++i)
+      for (unsigned int j = 0; j < N; ++j)
+        ret(j, i) = (*this)(i, j);
+    return ret;
+  }
+
+  /// Frobenius norm of the matrix.
+  Real norm() const
+  {
+    Real sum = 0.0;
+    for (unsigned int i = 0; i < M * N; ++i)
+      sum += _values[i] * _values[i];
+    return std::sqrt(sum);
+  }
+
+  /// Matrix product.
+  template <unsigned int P>
+  StaticMatrix<M, P> operator*(const StaticMatrix<N, P> & rhs) const
+  {
+    StaticMatrix<M, P> ret;
+    for (unsigned int i = 0; i < M; ++i)
+      for (unsigned int j = 0; j < P; ++j)
+        for (unsigned int k = 0; k < N; ++k)
+          ret(i, j) += (*this)(i, k) * rhs(k, j);
+    return ret;
+  }
+
+  /// Product of the transpose of this matrix with rhs, without forming the
+  /// transpose.
+  template <unsigned int P>
+  StaticMatrix<N, P> transposeMult(const StaticMatrix<M, P> & rhs) const
+  {
+    StaticMatrix<N, P> ret;
+    for (unsigned int i = 0; i < N; ++i)
+      for (unsigned int j = 0; j < P; ++j)
+        for (unsigned int k = 0; k < M; ++k)
+          ret(i, j) += (*this)(k, i) * rhs(k, j);
+    return ret;
+  }
+
+  /// Transformation T^T K T of the M x M matrix K by this matrix T.
+  StaticMatrix<N, N> transform(const StaticMatrix<M, M> & K) const
+  {
+    return transposeMult(K) * (*this);
+  }
+
+  StaticMatrix & operator+=(const StaticMatrix & rhs)
+  {
+    for (unsigned int i = 0; i < M * N; ++i)
+      _values[i] += rhs._values[i];
+    return *this;
+  }
+
+  StaticMatrix & operator-=(const StaticMatrix & rhs)
+  {
+    for (unsigned int i = 0; i < M * N; ++i)
+      _values[i] -= rhs._values[i];
+    return *this;
+  }
+
+  StaticMatrix & operator*=(const Real scalar)
+  {
+    for (unsigned int i = 0; i < M * N; ++i)
+      _values[i] *= scalar;
+    return *this;
+  }
+
+  StaticMatrix operator+(const StaticMatrix & rhs) const { return StaticMatrix(*this) += rhs; }
+  StaticMatrix operator-(const StaticMatrix & rhs) const { return StaticMatrix(*this) -= rhs; }
+  StaticMatrix operator*(const Real scalar) const { return StaticMatrix(*this) *= scalar; }
+
+  /// Copies the matrix into a ColumnMajorMatrix, which is only resized if it
+  /// does not have the same number of entries.
+  void copyTo(ColumnMajorMatrix & cmm) const
+  {
+    cmm.reshape(M, N);
+    for (unsigned int i = 0; i < M * N; ++i)
+      cmm(i) = _values[i];
+  }
+
+private:
+  /// Entries in column major order.
+  Real _values[M * N];
+};
+
+template <unsigned int M, unsigned int N>
+inline void
+dataStore(std::ostream & stream, StaticMatrix<M, N> & v, void * context)
+{
+  for (unsigned int i = 0; i < M * N; ++i)
+    dataStore(stream, v(i), context);
+}
+
+template <unsigned int M, unsigned int N>
+inline void
+dataLoad(std::istream & stream, StaticMatrix<M, N> & v, void * context)
+{
+  for (unsigned int i = 0; i < M * N; ++i)
+    dataLoad(stream, v(i), context);
+}
+
+#endif // STATICMATRIX_H
@@ -0,0 +1,65 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef STRIDEDARRAY_H
+#define STRIDEDARRAY_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+/**
+ * StridedArray is a read-only view of n values that are stored stride
+ * values apart, such as a column of a row-major table. It does not own the
+ * values. A std::vector is viewed with a stride of one.
+ */
+class StridedArray
+{
+public:
+  StridedArray(const Real * data, const std::size_t size, const std::size_t stride = 1)
+    : _data(data), _size(size), _stride(stride)
+  {
+  }
+
+  StridedArray(const std::vector<Real> & vec) : _data(vec.data()), _size(vec.size()), _stride(1) {}
+
+  /// Number of values.
+  std::size_t size() const { return _size; }
+
+  /// Whether there are no values.
+  bool empty() const { return _size == 0; }
+
+  /// Distance between consecutive values in the underlying storage.
+  std::size_t stride() const { return _stride; }
+
+  /// Pointer to the first value.
+  const Real * data() const { return _data; }
+
+  const Real & operator[](const std::size_t i) const { return _data[i * _stride]; }
+
+  /// Last value.
+  const Real & back() const { return _data[(_size - 1) * _stride]; }
+
+  /// View of the values starting from the i-th one.
+  StridedArray tail(const std::size_t i) const
+  {
+    return StridedArray(_data + i * _stride, _size - i, _stride);
+  }
+
+protected:
+  const Real * _data;
+  std::size_t _size;
+  std::size_t _stride;
+};
+
+#endif // STRIDEDARRAY_H
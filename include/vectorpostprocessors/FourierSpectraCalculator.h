@@ -0,0 +1,67 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef FOURIERSPECTRACALCULATOR_H
+#define FOURIERSPECTRACALCULATOR_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+/**
+ *  FourierSpectraCalculator is a type of GeneralVectorPostprocessor that
+ *  computes the Fourier amplitude spectra and power spectral densities of the
+ *  response histories from a ResponseHistoryBuilder vectorpostprocessor
+ *  using an FFT. Optionally, the transfer functions of the histories with
+ *  respect to a reference history (e.g., the input motion at the bedrock) are
+ *  computed as the ratios of their Fourier amplitude spectra.
+ */
+class FourierSpectraCalculator : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+  FourierSpectraCalculator(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+
+protected:
+  /// dt to which the histories are regularized before the FFT.
+  const Real & _reg_dt;
+
+  /// Whether the Fourier amplitude spectra are smoothed.
+  const bool _smoothing;
+
+  /// Bandwidth coefficient of the Konno-Ohmachi smoothing window.
+  const Real & _bandwidth;
+
+  /// Reference to the frequency vector.
+  VectorPostprocessorValue & _frequency;
+
+  /// Vector of pointers to the vectors of spectral values.
+  std::vector<VectorPostprocessorValue *> _spectrum;
+
+  /// Histories from the ResponseHistoryBuilder vectorpostprocessor.
+  std::vector<const VectorPostprocessorValue *> _history;
+
+  /// Vector containing the time values in the simulation.
+  const VectorPostprocessorValue & _history_time;
+
+  /// Reference history for the transfer functions.
+  const VectorPostprocessorValue * _reference;
+
+  /// Time values of the reference history.
+  const VectorPostprocessorValue * _reference_time;
+};
+
+#endif
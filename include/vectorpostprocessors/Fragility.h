@@ -18,6 +18,10 @@
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 
+// MASTODON includes
+#include "SpectrumOscillatorBank.h"
+#include "ResponseHistoryFile.h"
+
 /**
  *  The `Fragility` VectorPostprocessor computes the seismic fragility of a component
  *  given the dynamic properties of the component, capacity distribution of the component,
@@ -41,6 +45,11 @@ public:
    *  the SSC.
    */
   std::vector<Real> calcDemandsFromRHFiles(unsigned int bin);
+  /**
+   *  Function to calculate the spectral demand at the frequency of the SSC
+   *  from one response history.
+   */
+  Real calcSpectralDemand(const StridedArray & demand_sample, const StridedArray & demand_time);
   /**
    *  Function to read the vectors of spectral demands from the stochastic demand
    *  files.
@@ -66,9 +75,19 @@ protected:
   /// Damping ratio of the ssc for spectral acceleration demand calculation
   const Real * _ssc_xi;
 
+  /// Name of the ResponseHistoryBuilder in the probabilistic simulations
+  /// whose binary history files are read instead of the csv files
+  const std::string * _history_builder;
+
   /// Time step of the simulations
   const Real * _dtsim;
 
+  /// Time integration scheme for the response spectra calculation
+  const SpectrumOscillatorBank::Integration _integration;
+
+  /// Buffer for the regularized demand sample, reused for all the files
+  std::vector<Real> _reg_sample;
+
   /// bool for response history files
   const bool _rh_file_exist;
 
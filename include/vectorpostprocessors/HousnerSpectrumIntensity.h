@@ -18,6 +18,10 @@
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 
+// MASTODON includes
+#include "SpectrumOscillatorBank.h"
+#include "ResponseHistoryFile.h"
+
 /**
  *  HousnerSpectrumIntensity is a type of GeneralVectorPostprocessor that computes the
  *  Housner Spectrum Intensity (HSI) for the given acceleration variables from a
@@ -54,7 +58,10 @@ protected:
   /// dt for HSI calculation. This dt will also be used to
   /// regularize the acceleration response to a uniform dt before calculating
   /// the response spectra for HSI.
-  const Real & _reg_dt;
+  const Real _reg_dt;
+
+  /// Time integration scheme for the oscillators.
+  const SpectrumOscillatorBank::Integration _integration;
 
   /// Vector containing the HSIs for all the variables. This vector is ouput
   /// into a csv file along with the variable names.
@@ -66,6 +73,14 @@ protected:
 
   /// Vector containing the time values in the simulation.
   const VectorPostprocessorValue & _history_time;
+
+  /// Binary file containing the histories, if the ResponseHistoryBuilder
+  /// writes one.
+  std::string _history_file_name;
+
+  /// Buffer for the regularized acceleration history, reused for all the
+  /// histories.
+  std::vector<Real> _reg_acc;
 };
 
 #endif
@@ -18,6 +18,9 @@
 // MOOSE includes
 #include "NodalVectorPostprocessor.h"
 
+// MASTODON includes
+#include "ResponseHistoryFile.h"
+
 /**
  *  ResponseHistoryBuilder is a type of NodalVectorPostprocessor that builds the
  *  response histories of a nodal response such as acceleration, velocity,
@@ -35,13 +38,35 @@ public:
   const std::vector<VectorPostprocessorValue *> & getHistories() const;
   const std::vector<std::string> & getHistoryNames() const;
 
+  /// Whether the histories are written to a binary file instead of being
+  /// stored in memory.
+  bool binaryOutput() const;
+
+  /// Name of the binary file, in which the first column is the time and the
+  /// other columns are the histories, in the same order as getHistoryNames().
+  std::string historyFileName() const;
+
 protected:
+  /// Collects the values of the current time step from all the processors
+  /// into data, which is sized for the number of histories.
+  void gatherCurrentData(std::vector<Real> & data);
+
   /// Vector containing the names of the variables where the response spectrum
   /// is requested.
   const std::vector<VariableName> & _var_names;
 
-  /// Reference to the time vector from the analysis.
-  VectorPostprocessorValue & _history_time;
+  /// Whether the time and history vectors are declared and stored. Objects
+  /// that only need the values of the current time step set this to false.
+  const bool _declare_histories;
+
+  /// Whether the histories are written to a binary file.
+  const bool _binary_output;
+
+  /// Writer for the binary file, which only exists on the root processor.
+  std::unique_ptr<ResponseHistoryFileWriter> _history_file;
+
+  /// Pointer to the time vector from the analysis.
+  VectorPostprocessorValue * _history_time;
 
   /// Vector of pointers to the response histories of different variables at the node.
   std::vector<VectorPostprocessorValue *> _history;
@@ -52,11 +77,16 @@ protected:
   /// Vector of pointers to the values of the variables at each time step.
   std::vector<const VariableValue *> _variables;
 
-  /// Map with (key, value) = (nodeid, location of VPP in _history)
-  std::map<dof_id_type, std::size_t> _node_map;
+  /// Sorted ids of the requested nodes. The position of a node id is the
+  /// location of its VPPs in _history.
+  std::vector<dof_id_type> _node_ids;
 
-  /// Stores the data for each VPP on the current timestep
+  /// Stores the data for each VPP on the current timestep, in the same order
+  /// as _history, which is also the order of a row of the binary file
   std::vector<Real> _current_data;
+
+  /// Indices in _current_data of the entries computed on this processor
+  std::vector<std::size_t> _owned_entries;
 };
 
 #endif
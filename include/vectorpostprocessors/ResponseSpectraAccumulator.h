@@ -0,0 +1,97 @@
+/*************************************************/
+/*           DO NOT MODIFY THIS HEADER           */
+/*                                               */
+/*                     MASTODON                  */
+/*                                               */
+/*    (c) 2015 Battelle Energy Alliance, LLC     */
+/*            ALL RIGHTS RESERVED                */
+/*                                               */
+/*   Prepared by Battelle Energy Alliance, LLC   */
+/*     With the U. S. Department of Energy       */
+/*                                               */
+/*     See COPYRIGHT for full restrictions       */
+/*************************************************/
+
+#ifndef RESPONSESPECTRAACCUMULATOR_H
+#define RESPONSESPECTRAACCUMULATOR_H
+
+// MASTODON includes
+#include "ResponseHistoryBuilder.h"
+#include "SpectrumOscillatorBank.h"
+
+/**
+ *  ResponseSpectraAccumulator is a type of NodalVectorPostprocessor that
+ *  computes the response spectra (pseudo displacement, pseudo velocity and
+ *  pseudo acceleration) of nodal acceleration responses while the simulation
+ *  is running. The oscillators are advanced at the end of every time step
+ *  with the newly computed accelerations, so that the response histories are
+ *  not stored and the spectra are available at any time.
+ */
+class ResponseSpectraAccumulator : public ResponseHistoryBuilder
+{
+public:
+  static InputParameters validParams();
+  ResponseSpectraAccumulator(const InputParameters & parameters);
+  virtual void finalize() override;
+
+protected:
+  /// Advances the oscillators of the l-th history computed on this processor
+  /// through the regularized samples of the current time step.
+  void advanceHistory(const std::size_t l, const std::vector<Real> & data);
+
+  /// Gathers the peak displacements of all the histories on the root
+  /// processor and computes the spectra from them.
+  void gatherSpectra();
+
+  /// Damping ratio.
+  const Real & _xi;
+
+  /// Start frequency for the response spectra calculation.
+  const Real & _freq_start;
+
+  /// End frequency for the response spectra calculation.
+  const Real & _freq_end;
+
+  /// Number of frequencies for the response spectra calculation.
+  const unsigned int & _freq_num;
+
+  /// dt for the response spectra calculation. The acceleration responses are
+  /// regularized to this dt as they are computed.
+  const Real & _reg_dt;
+
+  /// Number of time steps between the updates of the spectra vectors.
+  const unsigned int & _spectra_interval;
+
+  /// Reference to the frequency vector.
+  VectorPostprocessorValue & _frequency;
+
+  /// Reference to the period vector.
+  VectorPostprocessorValue & _period;
+
+  /// Vector of pointers to the vectors of spectral values.
+  std::vector<VectorPostprocessorValue *> _spectrum;
+
+  /// Oscillators for each of the histories computed on this processor.
+  std::vector<SpectrumOscillatorBank> _banks;
+
+  /// Indices of the histories computed on this processor.
+  std::vector<std::size_t> _local_histories;
+
+  /// Natural circular frequencies of the oscillators.
+  std::vector<Real> _om_n;
+
+  /// Time at the previous time step.
+  Real _prev_time;
+
+  /// Accelerations of all the histories at the previous time step.
+  std::vector<Real> _prev_data;
+
+  /// Time of the next regularized sample.
+  Real _reg_time;
+
+  /// Interpolation weights, between the previous and current time steps, of
+  /// the regularized samples that fall within the current time step.
+  std::vector<Real> _reg_weights;
+};
+
+#endif
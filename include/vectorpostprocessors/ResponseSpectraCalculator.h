@@ -18,6 +18,10 @@
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 
+// MASTODON includes
+#include "SpectrumOscillatorBank.h"
+#include "ResponseHistoryFile.h"
+
 /**
  *  ResponseSpectraCalculator is a type of VectorPostprocessor that computes the
  *  response spectra (pseudo displacement, pseudo velocity and pseudo
@@ -32,8 +36,16 @@ public:
   virtual void initialSetup() override;
   virtual void initialize() override;
   virtual void execute() override;
+  virtual void finalize() override;
 
 protected:
+  /// Computes the three spectra for the i-th history and stores them in
+  /// _local_spectrum. reg_acc is the buffer for the regularized history.
+  void computeSpectrum(const std::size_t i,
+                       const StridedArray & history_acc,
+                       const StridedArray & history_time,
+                       std::vector<Real> & reg_acc);
+
   /// Damping ratio.
   const Real & _xi;
 
@@ -51,7 +63,10 @@ protected:
   /// dt for response spectra calculation. This dt will also be used to
   /// regularize the acceleration response to a uniform dt before calculating
   /// the response spectra.
-  const Real & _reg_dt;
+  const Real _reg_dt;
+
+  /// Time integration scheme for the oscillators.
+  const SpectrumOscillatorBank::Integration _integration;
 
   /// Reference to the frequency vector.
   VectorPostprocessorValue & _frequency;
@@ -68,6 +83,19 @@ protected:
 
   /// Vector containing the time values in the simulation.
   const VectorPostprocessorValue & _history_time;
+
+  /// Binary file containing the histories, if the ResponseHistoryBuilder
+  /// writes one.
+  std::string _history_file_name;
+
+  /// Spectra computed on this processor, stored as [sd, sv, sa] for each
+  /// history, one after the other. The entries for the histories that are
+  /// computed on other processors are zero.
+  std::vector<Real> _local_spectrum;
+
+  /// Whether the histories are already at a constant time step of
+  /// regularize_dt, in which case they are not regularized.
+  bool _uniform;
 };
 
 #endif
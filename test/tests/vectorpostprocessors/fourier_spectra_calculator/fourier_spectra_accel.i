@@ -0,0 +1,87 @@
+# Test for the FourierSpectraCalculator with the acceleration history of the
+# ResponseSpectraCalculator test. The y acceleration is twice the x
+# acceleration, so that the transfer functions of the x and y accelerations
+# with respect to the x acceleration are 1 and 2 at all the frequencies.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  # dummy variable
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+[]
+
+[AuxKernels]
+  [./accel_x]
+    type = FunctionAux
+    variable = accel_x
+    function = accel_bottom_x
+    execute_on = 'initial timestep_end'
+  [../]
+  [./accel_y]
+    type = FunctionAux
+    variable = accel_y
+    function = accel_bottom_y
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Functions]
+  [./accel_bottom_x]
+    type = PiecewiseLinear
+    data_file = '../response_spectra_calculator/accel.csv'
+    format = columns
+    scale_factor = 1.0
+  [../]
+  [./accel_bottom_y]
+    type = PiecewiseLinear
+    data_file = '../response_spectra_calculator/accel.csv'
+    format = columns
+    scale_factor = 2.0
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 32
+  dt = 0.005
+  num_steps = 200
+[]
+
+[Outputs]
+  [./out]
+    type = CSV
+    execute_on = 'final'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./accel_hist]
+    type = ResponseHistoryBuilder
+    variables = 'accel_x accel_y'
+    nodes = '0'
+  [../]
+  [./accel_fourier]
+    type = FourierSpectraCalculator
+    vectorpostprocessor = accel_hist
+    regularize_dt = 0.005
+    reference_vectorpostprocessor = accel_hist
+    reference_history = node_0_accel_x
+    outputs = out
+  [../]
+[]
@@ -0,0 +1,70 @@
+# Test for the FourierSpectraCalculator with a pure sine history. The 4 Hz
+# sine is sampled at dt = 1/64 s for exactly four cycles, so that, in the
+# absence of smoothing, its Fourier amplitude, |X_k| dt = (64/2) dt = 0.5, and
+# its power spectral density, 2 |X_k|^2 dt / 64 = 0.5, are at the 4 Hz
+# frequency only.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  # dummy variable
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./accel_x]
+  [../]
+[]
+
+[AuxKernels]
+  [./accel_x]
+    type = FunctionAux
+    variable = accel_x
+    function = sine
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Functions]
+  [./sine]
+    type = ParsedFunction
+    expression = 'sin(2.0 * pi * 4.0 * t)'
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  dt = 0.015625
+  num_steps = 63
+[]
+
+[Outputs]
+  [./out]
+    type = CSV
+    execute_on = 'final'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./accel_hist]
+    type = ResponseHistoryBuilder
+    variables = 'accel_x'
+    nodes = '0'
+  [../]
+  [./sine_fourier]
+    type = FourierSpectraCalculator
+    vectorpostprocessor = accel_hist
+    regularize_dt = 0.015625
+    outputs = out
+  [../]
+[]
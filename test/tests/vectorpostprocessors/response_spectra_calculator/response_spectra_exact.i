@@ -0,0 +1,85 @@
+# Test for the ResponseSpectraCalculator with the piecewise-exact integration.
+# The acceleration histories are the acceleration input of the
+# response_spectra_calculator.i test, scaled by 1 in x and 2 in y, and are
+# used directly at the simulation time steps.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  # dummy variable
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+[]
+
+[AuxKernels]
+  [./accel_x]
+    type = FunctionAux
+    variable = accel_x
+    function = accel_bottom_x
+    execute_on = 'initial timestep_end'
+  [../]
+  [./accel_y]
+    type = FunctionAux
+    variable = accel_y
+    function = accel_bottom_y
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Functions]
+  [./accel_bottom_x]
+    type = PiecewiseLinear
+    data_file = 'accel.csv'
+    format = columns
+    scale_factor = 1.0
+  [../]
+  [./accel_bottom_y]
+    type = PiecewiseLinear
+    data_file = 'accel.csv'
+    format = columns
+    scale_factor = 2.0
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 32
+  dt = 0.005
+  num_steps = 200
+[]
+
+[Outputs]
+  [./out]
+    type = CSV
+    execute_on = 'final'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./accel_hist]
+    type = ResponseHistoryBuilder
+    variables = 'accel_x accel_y'
+    nodes = '0'
+  [../]
+  [./accel_spec]
+    type = ResponseSpectraCalculator
+    vectorpostprocessor = accel_hist
+    integration = exact
+    outputs = out
+  [../]
+[]